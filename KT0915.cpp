@@ -27,6 +27,48 @@ void KT0915::setI2CBusAddress(int deviceAddress)
     this->deviceAddress = deviceAddress;
 }
 
+/**
+ * @ingroup GA03
+ * @brief Sets the wait time after each register access
+ * @details setRegister and getRegister wait this time after each I2C transaction. The default value is 6000us (6ms).
+ * @details Use the sketch KT0915_02_SETTLE_TIME to find the shortest safe value for your circuit.
+ *
+ * @param value  time in microseconds
+ */
+void KT0915::setRegisterDelay(uint16_t value)
+{
+    this->registerDelay = value;
+}
+
+/**
+ * @ingroup GA03
+ * @brief Sets the wait time after each tune command
+ * @details setFrequency, frequencyUp and frequencyDown wait this time after writing the channel. The default value is 30ms.
+ * @details Use the sketch KT0915_02_SETTLE_TIME to find the shortest safe value for your circuit.
+ *
+ * @param value  time in milliseconds
+ */
+void KT0915::setTuneDelay(uint16_t value)
+{
+    this->tuneDelay = value;
+}
+
+/**
+ * @ingroup GA03
+ * @brief Sets the way consecutive registers are read
+ * @details When enabled, getStatus, setFrequencyAndGetStatus and getStatusAndSetFrequency read STATUSA, STATUSB and STATUSC
+ * @details in a single data phase (2 addressing phases), relying on the device register address auto-increment.
+ * @details When disabled (default), only STATUSA and STATUSC are read, each one addressed by a repeated start in the
+ * @details same I2C transaction (4 addressing phases). STATUSB (kt09xx_status::statusb) is 0 in this case.
+ * @details Enable it only if your device returns the right values (compare getStatus with getFmRssi and getFmSnr).
+ *
+ * @param value  true = single data phase; false = one repeated start per register
+ */
+void KT0915::setI2CSequentialRead(bool value)
+{
+    this->sequentialRead = value;
+}
+
 /**
  * @ingroup GA03
  * @brief Sets the a value to a given KT09XX register
@@ -47,7 +89,7 @@ void KT0915::setRegister(int reg, uint16_t parameter)
     Wire.write(param.refined.lowByte);
 
     Wire.endTransmission();
-    delayMicroseconds(6000);
+    delayMicroseconds(this->registerDelay);
 }
 
 /**
@@ -65,16 +107,105 @@ uint16_t KT0915::getRegister(int reg)
     Wire.beginTransmission(this->deviceAddress);
     Wire.write(reg);
     Wire.endTransmission(false);
-    delayMicroseconds(6000);
+    delayMicroseconds(this->registerDelay);
     Wire.requestFrom(this->deviceAddress, 2);
     result.refined.highByte = Wire.read();
     result.refined.lowByte = Wire.read();
     Wire.endTransmission(true);
-    delayMicroseconds(6000);
+    delayMicroseconds(this->registerDelay);
 
     return result.raw;
 }
 
+/**
+ * @ingroup GA03
+ * @brief Reads consecutive registers without releasing the bus
+ * @details Every phase after the first one starts with a repeated start. The bus is released (stop) only if stop is true.
+ * @details There is no wait time between the phases.
+ * @see setI2CSequentialRead
+ *
+ * @param reg    first register
+ * @param count  number of registers
+ * @param data   register contents
+ * @param stop   true = releases the bus after the last register
+ */
+void KT0915::readRegisters(uint8_t reg, uint8_t count, uint16_t *data, bool stop)
+{
+    word16_to_bytes result;
+    uint8_t phases = (this->sequentialRead) ? 1 : count;
+    uint8_t perPhase = count / phases;
+
+    for (uint8_t p = 0; p < phases; p++)
+    {
+        Wire.beginTransmission(this->deviceAddress);
+        Wire.write(reg + p * perPhase);
+        Wire.endTransmission(false);
+        Wire.requestFrom(this->deviceAddress, perPhase * 2, (int) (stop && p == phases - 1));
+        for (uint8_t i = 0; i < perPhase; i++)
+        {
+            result.refined.highByte = Wire.read();
+            result.refined.lowByte = Wire.read();
+            data[p * perPhase + i] = result.raw;
+        }
+    }
+}
+
+/**
+ * @ingroup GA03
+ * @brief Reads the status registers of the current mode without releasing the bus
+ * @details FM: STATUSA and STATUSC (and STATUSB in the sequential read mode). AM: only AMSTATUSA (the FM registers are set to 0).
+ * @param status  status registers
+ * @param stop    true = releases the bus after the last register
+ */
+void KT0915::readStatus(kt09xx_status *status, bool stop)
+{
+    uint16_t data[3];
+
+    if (this->currentMode == MODE_AM)
+    {
+        status->statusa.raw = status->statusb.raw = status->statusc.raw = 0;
+        readRegisters(REG_AMSTATUSA, 1, &status->amstatusa.raw, stop);
+        return;
+    }
+
+    if (this->sequentialRead)
+    {
+        readRegisters(REG_STATUSA, 3, data, stop); // Single data phase: STATUSB comes for free
+        status->statusb.raw = data[1];
+    }
+    else
+    {
+        readRegisters(REG_STATUSA, 1, &data[0], false);
+        readRegisters(REG_STATUSC, 1, &data[2], stop);
+        status->statusb.raw = 0;
+    }
+    status->statusa.raw = data[0];
+    status->statusc.raw = data[2];
+    status->amstatusa.raw = 0;
+}
+
+/**
+ * @ingroup GA03
+ * @brief Writes the tune command (TUNE or AMCHAN) and releases the bus
+ * @details The register value is given by kt0915ChannelValue (also used by the boot image). There is no wait time.
+ * @see setFrequency
+ * @param frequency  frequency in KHz
+ */
+void KT0915::writeChannel(uint32_t frequency)
+{
+    word16_to_bytes param;
+
+    param.raw = kt0915ChannelValue(this->currentMode, frequency);
+
+    Wire.beginTransmission(this->deviceAddress);
+    Wire.write((uint8_t)((this->currentMode == MODE_AM) ? REG_AMCHAN : REG_TUNE));
+    Wire.write(param.refined.highByte);
+    Wire.write(param.refined.lowByte);
+    Wire.endTransmission();
+
+    this->currentFrequency = frequency;
+}
+
 /**
  * @ingroup GA03
  * @brief Gets the Device Id 
@@ -492,6 +623,100 @@ void KT0915::setup(int enable_pin, uint8_t oscillator_type, uint8_t ref_clock)
     setVolume(this->currentVolume);
 }
 
+/**
+ * @ingroup GA03
+ * @brief   Receiver startup from a boot image
+ * @details Replaces setup, setFM/setAM and the setters usually called after them by a single pass of register writes.
+ * @details The image is built at compile time by kt0915BootImage and can be stored in the flash memory (PROGMEM).
+ * @details No register is read to be changed. At runtime, only the crystal ready status is checked after the clock setup.
+ * @details The bits not set by the configuration keep the power on values given to kt0915BootImage (see getBootBase).
+ * @details The registers are written one after another without the settle time used by setRegister.
+ *
+ * @code
+ * #include <KT0915.h>
+ * constexpr kt09xx_boot_base bootBase = {0x...}; // Printed by getBootBase (see the sketch KT0915_03_BOOT_IMAGE)
+ * constexpr kt09xx_boot_config bootConfig = {MODE_FM, 84000, 108000, 103900, 100, 1, 0, OSCILLATOR_32KHZ, REF_CLOCK_DISABLE, 25, DE_EMPHASIS_75, 1, 1};
+ * const kt09xx_boot_image bootImage PROGMEM = kt0915BootImage(bootConfig, bootBase);
+ * KT0915 radio;
+ * void setup() {
+ *    radio.applyBootImage(RESET_PIN, &bootImage);
+ * }
+ * @endcode
+ *
+ * @see kt09xx_boot_config, kt0915BootImage, getBootBase, setup
+ *
+ * @param enable_pin  if >= 0,  then you control the device enable or disable status. if -1, you are using the circuit to crontole that.
+ * @param image       pointer to the boot image stored in the flash memory (PROGMEM)
+ * @return true if the crystal is ready
+ */
+bool KT0915::applyBootImage(int enable_pin, const kt09xx_boot_image *image)
+{
+    kt09xx_boot_image img;
+    word16_to_bytes param;
+    bool ready = false;
+
+    memcpy_P(&img, image, sizeof(kt09xx_boot_image));
+
+    this->enablePin = enable_pin;
+    enable(1);
+
+    for (uint8_t i = 0; i < KT0915_BOOT_IMAGE_SIZE; i++)
+    {
+        param.raw = img.reg[i].value;
+        Wire.beginTransmission(this->deviceAddress);
+        Wire.write(img.reg[i].reg);
+        Wire.write(param.refined.highByte);
+        Wire.write(param.refined.lowByte);
+        Wire.endTransmission();
+
+        if (i == 0) // The first register sets the clock. Waits for the crystal before going on.
+        {
+            for (uint8_t attempt = 0; attempt < 50 && !(ready = isCrystalReady()); attempt++)
+                delay(10);
+        }
+    }
+
+    this->currentMode = img.config.mode;
+    this->minimumFrequency = img.config.minimum_frequency;
+    this->maximumFrequency = img.config.maximum_frequency;
+    this->currentFrequency = img.config.default_frequency;
+    this->currentStep = img.config.step;
+    this->currentFmSpace = img.config.fm_space;
+    this->currentAmSpace = img.config.am_space;
+    this->currentRefClockType = img.config.oscillator_type;
+    this->currentRefClockEnabled = img.config.ref_clock;
+    this->currentVolume = img.config.volume;
+    this->currentDialMode = DIAL_MODE_OFF;
+
+    delay(this->tuneDelay);
+
+    return ready;
+}
+
+/**
+ * @ingroup GA03
+ * @brief   Reads the power on values of the registers changed by a boot image
+ * @details Call it right after the device is powered on, before any other method. Print the values and use them
+ * @details as the kt09xx_boot_base given to kt0915BootImage. It is needed once for a given device (see the sketch KT0915_03_BOOT_IMAGE).
+ * @see kt09xx_boot_base, kt0915BootImage, applyBootImage
+ * @param enable_pin  if >= 0,  then you control the device enable or disable status. if -1, you are using the circuit to crontole that.
+ * @param base        receives the register values
+ */
+void KT0915::getBootBase(int enable_pin, kt09xx_boot_base *base)
+{
+    this->enablePin = enable_pin;
+    enable(1);
+
+    base->amsyscfg = getRegister(REG_AMSYSCFG);
+    base->seek = getRegister(REG_SEEK);
+    base->volume = getRegister(REG_VOLUME);
+    base->dspcfga = getRegister(REG_DSPCFGA);
+    base->locfga = getRegister(REG_LOCFGA);
+    base->locfgc = getRegister(REG_LOCFGC);
+    base->amcfg = getRegister(REG_AMCFG);
+    base->rxcfg = getRegister(REG_RXCFG);
+}
+
 /** 
  * @defgroup GA04 Tune Methods 
  * @section  GA04 Tune Methods  
@@ -565,6 +790,62 @@ int KT0915::getFmSnr()
 };
 
 
+/**
+ * @ingroup GA04
+ * @brief Gets the status registers in a single I2C transaction
+ * @details FM mode: reads STATUSA (FM RSSI, stereo) and STATUSC (FM SNR); STATUSB (channel) only in the sequential read mode (see setI2CSequentialRead).
+ * @details AM mode: reads only AMSTATUSA (AM RSSI).
+ * @details Use it instead of calling getFmRssi, getFmSnr and isFmStereo (one I2C transaction each).
+ * @details The RSSI value returned by getFmRssi is status.statusa.refined.FMRSSI * 3.
+ *
+ * @param status  status registers
+ */
+void KT0915::getStatus(kt09xx_status *status)
+{
+    readStatus(status, true);
+}
+
+/**
+ * @ingroup GA04
+ * @brief Tunes a frequency and gets the status
+ * @details Writes the channel, waits the tune delay (see setTuneDelay) and reads the status registers in a single transaction.
+ * @details There is no wait time after each register access (see setRegisterDelay).
+ *
+ * @param frequency  frequency in KHz
+ * @param status     status registers of the new channel
+ */
+void KT0915::setFrequencyAndGetStatus(uint32_t frequency, kt09xx_status *status)
+{
+    writeChannel(frequency);
+    delay(this->tuneDelay);
+    readStatus(status, true);
+}
+
+/**
+ * @ingroup GA04
+ * @brief Gets the status of the current channel and tunes the next one (pipelined scan)
+ * @details The status read and the tune command are sent in the same I2C transaction (repeated start).
+ * @details The method returns right after the tune command. Do something useful (log, display) and
+ * @details call it again after the tune delay.
+ *
+ * @code
+ * radio.setFrequency(first);
+ * for (uint32_t f = first + step; f <= last + step; f += step) {
+ *    uint32_t tuned = radio.getFrequency();
+ *    radio.getStatusAndSetFrequency(f, &status);   // status of "tuned"; starts tuning "f"
+ *    ...                                           // uses status; waits the tune delay
+ * }
+ * @endcode
+ *
+ * @param next_frequency  next frequency in KHz
+ * @param status          status registers of the current channel
+ */
+void KT0915::getStatusAndSetFrequency(uint32_t next_frequency, kt09xx_status *status)
+{
+    readStatus(status, false);
+    writeChannel(next_frequency);
+}
+
 /**
  * @ingroup GA04
  * @brief Sets the De-emphasis Time Constant Selection
@@ -587,6 +868,7 @@ void KT0915::setDeEmphasis(uint8_t value)
 void KT0915::setFmAfc(bool value)
 {
     kt09xx_locfga r;
+    r.raw = getRegister(REG_LOCFGA); // Gets the current value of the register
     r.refined.FMAFCD = !value;
     setRegister(REG_LOCFGA, r.raw);
 }
@@ -779,31 +1061,15 @@ void KT0915::setAM(uint32_t minimum_frequency, uint32_t maximum_frequency, uint3
 /**
  * @ingroup GA04
  * @brief Sets the current frequency
+ * @details Writes the tune command and waits the register delay and the tune delay (see setRegisterDelay and setTuneDelay).
  * 
  * @param frequency 
  */
 void KT0915::setFrequency(uint32_t frequency)
 {
-    kt09xx_amchan reg_amchan;
-    kt09xx_tune reg_tune;
-
-    if (this->currentMode == MODE_AM)
-    {
-        reg_amchan.refined.AMTUNE = 1; // TODO Check
-        reg_amchan.refined.AMCHAN = frequency;
-        setRegister(REG_AMCHAN, reg_amchan.raw);
-    }
-    else
-    {
-        reg_tune.refined.FMTUNE = 1; // // TODO Check
-        reg_tune.refined.RESERVED = 0;
-        reg_tune.refined.FMCHAN = frequency / 50;
-        setRegister(REG_TUNE, reg_tune.raw);
-    }
-
-    this->currentFrequency = frequency;
-
-    delay(30);
+    writeChannel(frequency);
+    delayMicroseconds(this->registerDelay); // Same wait setRegister used to apply after the tune write
+    delay(this->tuneDelay);
 }
 
 /**
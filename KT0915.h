@@ -459,10 +459,10 @@ typedef union {
 typedef union {
     struct
     {
-        uint8_t RESERVED1 : 5;      //!< Reserved
-        uint8_t KEY_MODE : 2;       //!< Working mode selection when key mode is selected.  00 = Working mode A; 01 = Working mode B Others = Reserved;  For detailed information about working mode A and working mode B, please refer to section 3.7.1.
-        uint8_t RESERVED2 : 7;      //!< Reserved
-        uint8_t AMSPACE : 2;        //!< AM Channel Space Selection; 00 = 1KHz; 01 = 9KHz; 10 = 10KHz; 11 = 10KHz.
+        uint16_t RESERVED1 : 5;     //!< Reserved
+        uint16_t KEY_MODE : 2;      //!< Working mode selection when key mode is selected.  00 = Working mode A; 01 = Working mode B Others = Reserved;  For detailed information about working mode A and working mode B, please refer to section 3.7.1.
+        uint16_t RESERVED2 : 7;     //!< Reserved
+        uint16_t AMSPACE : 2;       //!< AM Channel Space Selection; 00 = 1KHz; 01 = 9KHz; 10 = 10KHz; 11 = 10KHz.
     } refined;
     uint16_t raw;
 } kt09xx_amcfg; // AMCFG
@@ -510,7 +510,186 @@ typedef union {
 } word16_to_bytes;
 
 /**
- * @ingroup GA01  
+ * @ingroup GA01
+ * @brief Status registers read in a single I2C transaction
+ * @details In FM mode, STATUSA and STATUSC are read and amstatusa is 0. statusb is read only when the
+ * @details sequential read is enabled (see KT0915::setI2CSequentialRead); otherwise it is 0.
+ * @details In AM mode, only AMSTATUSA is read and the FM registers are 0.
+ * @see KT0915::getStatus, KT0915::setFrequencyAndGetStatus, KT0915::getStatusAndSetFrequency
+ */
+typedef struct {
+    kt09xx_statusa statusa;         //!< STATUSA (0x12): FM RSSI, stereo, STC
+    kt09xx_statusb statusb;         //!< STATUSB (0x13): current channel (sequential read only)
+    kt09xx_statusc statusc;         //!< STATUSC (0x14): FM SNR, chip ready
+    kt09xx_amdstatusa amstatusa;    //!< AMSTATUSA (0x24): AM RSSI
+} kt09xx_status;
+
+#define KT0915_BOOT_IMAGE_SIZE 9    // Number of registers written by applyBootImage
+
+/**
+ * @ingroup GA01
+ * @brief Power-on configuration description used to build a boot image
+ * @details All fields are plain values, so a kt09xx_boot_config can be declared constexpr and
+ * @details turned into a register image at compile time by kt0915BootImage.
+ * @details The image configures the device as the sequence below does:
+ * @details setup, setFM (or setAM), setFmSpace, setAmSpace, setVolume, setDeEmphasis, setFmAfc, setAmAfc and setSoftMute.
+ * @see kt0915BootImage, KT0915::applyBootImage
+ */
+typedef struct {
+    uint8_t  mode;                  //!< MODE_FM or MODE_AM
+    uint32_t minimum_frequency;     //!< Minimum frequency for the band (KHz)
+    uint32_t maximum_frequency;     //!< Maximum frequency for the band (KHz)
+    uint32_t default_frequency;     //!< Frequency tuned after boot (KHz)
+    uint16_t step;                  //!< Increment and decrement frequency step (KHz)
+    uint8_t  fm_space;              //!< FM Channel Spacing; 0 = 200KHz; 1 = 100KHz; 2 = 50KHz
+    uint8_t  am_space;              //!< AM Channel Space; 0 = 1KHz; 1 = 9KHz; 2 = 10KHz
+    uint8_t  oscillator_type;       //!< OSCILLATOR_32KHZ, OSCILLATOR_12MHZ etc
+    uint8_t  ref_clock;             //!< REF_CLOCK_DISABLE (crystal) or REF_CLOCK_ENABLE
+    uint8_t  volume;                //!< 0 (mute) to 31 (maximum)
+    uint8_t  de_emphasis;           //!< DE_EMPHASIS_75 or DE_EMPHASIS_50
+    uint8_t  afc;                   //!< 1 = AFC enabled (AM and FM); 0 = disabled
+    uint8_t  softmute;              //!< 1 = Softmute enabled (AM and FM); 0 = disabled
+} kt09xx_boot_config;
+
+/**
+ * @ingroup GA01
+ * @brief Register values of the device right after power on
+ * @details The boot image changes only the fields set by the configuration. All other bits (reserved,
+ * @details anti-pop, blend, audio gain, key mode etc) keep these values, as the read-modify-write setters do.
+ * @details The datasheet does not list reset values for all of these registers. So, read them once from
+ * @details your device with KT0915::getBootBase (see the sketch KT0915_03_BOOT_IMAGE) and paste them in your code.
+ */
+typedef struct {
+    uint16_t amsyscfg;
+    uint16_t seek;
+    uint16_t volume;
+    uint16_t dspcfga;
+    uint16_t locfga;
+    uint16_t locfgc;
+    uint16_t amcfg;
+    uint16_t rxcfg;
+} kt09xx_boot_base;
+
+/**
+ * @ingroup GA01
+ * @brief One register of a boot image (register number and the value to be written)
+ */
+typedef struct {
+    uint8_t reg;
+    uint16_t value;
+} kt09xx_boot_register;
+
+/**
+ * @ingroup GA01
+ * @brief Complete power-on register image
+ * @details The registers are stored in the order they must be written. The first one is AMSYSCFG (clock setup)
+ * @details and the last one is TUNE (FM) or AMCHAN (AM).
+ */
+typedef struct {
+    kt09xx_boot_config config;
+    kt09xx_boot_register reg[KT0915_BOOT_IMAGE_SIZE];
+} kt09xx_boot_image;
+
+/**
+ * @ingroup GA01
+ * @brief TUNE (FM) or AMCHAN (AM) register value that starts tuning the given frequency
+ * @param mode       MODE_FM or MODE_AM
+ * @param frequency  frequency in KHz
+ */
+constexpr uint16_t kt0915ChannelValue(uint8_t mode, uint32_t frequency)
+{
+    return (mode == MODE_AM) ? (uint16_t)(1 << 15 | (frequency & 0x7FFF))          // AMTUNE | AMCHAN<14:0>
+                             : (uint16_t)(1 << 15 | ((frequency / 50) & 0x0FFF));  // FMTUNE | FMCHAN<11:0>
+}
+
+/*
+ * Register values for the boot image. Each one replaces only the bits (mask) changed by the setters listed in
+ * kt09xx_boot_config and keeps the other bits of the power on value. The bit positions follow the register
+ * descriptions above (Datasheet section 3.10).
+ */
+constexpr uint16_t kt0915BootMerge(uint16_t base, uint16_t mask, uint16_t value)
+{
+    return (uint16_t)((base & ~mask) | (value & mask));
+}
+
+// AM_FM, USERBAND (Dial Mode Off), RCLK_EN, REFCLK, RESERVED1 (= 1, see setAmAfc) and AMAFCD
+constexpr uint16_t kt0915BootAmsyscfg(const kt09xx_boot_config &c, const kt09xx_boot_base &b)
+{
+    return kt0915BootMerge(b.amsyscfg, 0xDF3F, (uint16_t)((c.mode == MODE_AM) << 15 | (c.ref_clock & 1) << 12 | (c.oscillator_type & 0xF) << 8 | 1 << 1 | (c.afc ? 0 : 1)));
+}
+
+// FMSPACE
+constexpr uint16_t kt0915BootSeek(const kt09xx_boot_config &c, const kt09xx_boot_base &b)
+{
+    return kt0915BootMerge(b.seek, 0x000C, (uint16_t)((c.fm_space & 3) << 2));
+}
+
+// FMDSMUTE and AMDSMUTE
+constexpr uint16_t kt0915BootVolume(const kt09xx_boot_config &c, const kt09xx_boot_base &b)
+{
+    return kt0915BootMerge(b.volume, 0xC000, (uint16_t)(c.softmute ? 0 : 0xC000));
+}
+
+// DE
+constexpr uint16_t kt0915BootDspcfga(const kt09xx_boot_config &c, const kt09xx_boot_base &b)
+{
+    return kt0915BootMerge(b.dspcfga, 0x0800, (uint16_t)((c.de_emphasis & 1) << 11));
+}
+
+// FMAFCD
+constexpr uint16_t kt0915BootLocfga(const kt09xx_boot_config &c, const kt09xx_boot_base &b)
+{
+    return kt0915BootMerge(b.locfga, 0x0100, (uint16_t)((c.afc ? 0 : 1) << 8));
+}
+
+// CAMPUSBAND_EN (FM only, see setFM)
+constexpr uint16_t kt0915BootLocfgc(const kt09xx_boot_config &c, const kt09xx_boot_base &b)
+{
+    return (c.mode == MODE_FM) ? kt0915BootMerge(b.locfgc, 0x0008, (uint16_t)((c.maximum_frequency <= 64000) << 3)) : b.locfgc;
+}
+
+// AMSPACE
+constexpr uint16_t kt0915BootAmcfg(const kt09xx_boot_config &c, const kt09xx_boot_base &b)
+{
+    return kt0915BootMerge(b.amcfg, 0xC000, (uint16_t)((c.am_space & 3) << 14));
+}
+
+// VOLUME
+constexpr uint16_t kt0915BootRxcfg(const kt09xx_boot_config &c, const kt09xx_boot_base &b)
+{
+    return kt0915BootMerge(b.rxcfg, 0x001F, (uint16_t)(c.volume & 0x1F));
+}
+
+/**
+ * @ingroup GA01
+ * @brief Builds a boot image from a configuration description and the power on register values
+ * @details When the parameters are constant expressions, the whole image is computed by the compiler and
+ * @details can be stored in the flash memory (PROGMEM). See KT0915::applyBootImage.
+ * @code
+ * constexpr kt09xx_boot_base bootBase = {0x...}; // Printed by the sketch KT0915_03_BOOT_IMAGE
+ * constexpr kt09xx_boot_config bootConfig = {MODE_FM, 84000, 108000, 103900, 100, 1, 0, OSCILLATOR_32KHZ, REF_CLOCK_DISABLE, 25, DE_EMPHASIS_75, 1, 1};
+ * const kt09xx_boot_image bootImage PROGMEM = kt0915BootImage(bootConfig, bootBase);
+ * @endcode
+ * @param c  configuration description
+ * @param b  power on register values
+ * @return the register image
+ */
+constexpr kt09xx_boot_image kt0915BootImage(const kt09xx_boot_config &c, const kt09xx_boot_base &b)
+{
+    return {c,
+            {{REG_AMSYSCFG, kt0915BootAmsyscfg(c, b)},
+             {REG_SEEK, kt0915BootSeek(c, b)},
+             {REG_VOLUME, kt0915BootVolume(c, b)},
+             {REG_DSPCFGA, kt0915BootDspcfga(c, b)},
+             {REG_LOCFGA, kt0915BootLocfga(c, b)},
+             {REG_LOCFGC, kt0915BootLocfgc(c, b)},
+             {REG_AMCFG, kt0915BootAmcfg(c, b)},
+             {REG_RXCFG, kt0915BootRxcfg(c, b)},
+             {(uint8_t)((c.mode == MODE_AM) ? REG_AMCHAN : REG_TUNE), kt0915ChannelValue(c.mode, c.default_frequency)}}};
+}
+
+/**
+ * @ingroup GA01
  * @brief KT0915 Class 
  * @details This class implements all functions that will help you to control the KT0915 devices. 
  * 
@@ -539,6 +718,14 @@ protected:
 
     uint8_t currentVolume = 15;
 
+    uint16_t registerDelay = 6000;                          //!< Wait time after each register access (microseconds)
+    uint16_t tuneDelay = 30;                                //!< Wait time after each tune command (milliseconds)
+    bool sequentialRead = false;                            //!< true = reads consecutive registers in a single data phase (address auto-increment)
+
+    void readRegisters(uint8_t reg, uint8_t count, uint16_t *data, bool stop);
+    void readStatus(kt09xx_status *status, bool stop);
+    void writeChannel(uint32_t frequency);
+
 
 public:
     void setRegister(int reg, uint16_t parameter);
@@ -547,9 +734,15 @@ public:
     uint16_t getDeviceId();
     void enable(uint8_t on_off);
     void setI2CBusAddress(int deviceAddress);
+    void setRegisterDelay(uint16_t value);
+    void setTuneDelay(uint16_t value);
+    inline uint16_t getTuneDelay() { return this->tuneDelay; };
+    void setI2CSequentialRead(bool value);
     void setReferenceClockType(uint8_t crystal, uint8_t ref_clock = 0);
     bool isCrystalReady();
     void setup(int enable_pin, uint8_t oscillator_type = OSCILLATOR_32KHZ, uint8_t ref_clock = REF_CLOCK_DISABLE);
+    bool applyBootImage(int enable_pin, const kt09xx_boot_image *image);
+    void getBootBase(int enable_pin, kt09xx_boot_base *base);
 
     void setKeyMode(uint8_t value);
     void setKeyControl(uint8_t audioControl, uint8_t channelControl);
@@ -614,5 +807,9 @@ public:
     int getAmRssi();
     int getFmSnr();
 
+    void getStatus(kt09xx_status *status);
+    void setFrequencyAndGetStatus(uint32_t frequency, kt09xx_status *status);
+    void getStatusAndSetFrequency(uint32_t next_frequency, kt09xx_status *status);
+
 };
 
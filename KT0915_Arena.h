@@ -0,0 +1,131 @@
+/**
+ * @brief  PU2CLR KT0915 Arduino Library - Static memory arena
+ * @details Fixed-size memory pool shared by the scan, station list and logging buffers.
+ * @details There is no malloc and no fragmentation: regions are borrowed from the top of the pool and
+ * @details returned in the reverse order (stack discipline). The high-water mark shows the largest amount
+ * @details of memory used since the last reset, so you can size the arena for your board.
+ * @details This file does not depend on the Arduino core and can also be used on Linux.
+ * @copyright Copyright (c) 2026 KT0915 library contributors.
+ */
+
+#ifndef _KT0915_ARENA_H
+#define _KT0915_ARENA_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define KT0915_ARENA_ALIGN __BIGGEST_ALIGNMENT__     // Every region starts at this boundary (1 on AVR)
+
+/**
+ * @ingroup GA06
+ * @brief Bytes taken by count elements of the given type, including the alignment padding.
+ * @details Use it to size a KT0915_StaticArena at compile time. Example:
+ * @code
+ * KT0915_StaticArena<KT0915_ARENA_BYTES(uint8_t, 64) + KT0915_ARENA_BYTES(uint32_t, 32)> arena;
+ * @endcode
+ */
+#define KT0915_ARENA_BYTES(type, count) (((sizeof(type) * (count)) + KT0915_ARENA_ALIGN - 1) / KT0915_ARENA_ALIGN * KT0915_ARENA_ALIGN)
+
+/**
+ * @defgroup GA06 Static memory arena
+ * @section  GA06 Static memory arena
+ * @details  Fixed-size memory pool for scan, station list and telemetry buffers
+ */
+
+/**
+ * @ingroup GA06
+ * @brief Memory arena
+ * @details Components receive a reference to this class and do not need to know the arena size.
+ * @details The storage is provided by KT0915_StaticArena.
+ * @see KT0915_StaticArena
+ */
+class KT0915_Arena
+{
+
+protected:
+    uint8_t *pool;          //!< Arena storage
+    uint16_t size;          //!< Arena size in bytes
+    uint16_t top = 0;       //!< Offset of the first free byte
+    uint16_t highWater = 0; //!< Largest value of top since the last reset
+
+public:
+    KT0915_Arena(uint8_t *pool, uint16_t size) : pool(pool), size(size) {}
+
+    /**
+     * @ingroup GA06
+     * @brief Borrows a region from the arena
+     * @param bytes  region size
+     * @return pointer to the region or NULL if there is not enough room
+     */
+    void *borrow(uint16_t bytes)
+    {
+        // Rounded in 32 bits: near 65535 the aligned size does not fit in 16 bits.
+        uint32_t aligned = ((uint32_t)bytes + KT0915_ARENA_ALIGN - 1) / KT0915_ARENA_ALIGN * KT0915_ARENA_ALIGN;
+        if (aligned > (uint32_t)(this->size - this->top))
+            return NULL;
+
+        void *region = this->pool + this->top;
+        this->top += (uint16_t)aligned;
+        if (this->top > this->highWater)
+            this->highWater = this->top;
+        return region;
+    }
+
+    /**
+     * @ingroup GA06
+     * @brief Gives a region back to the arena
+     * @details The region and every region borrowed after it are released.
+     * @details Regions must be given back in the reverse order they were borrowed.
+     * @param region  pointer returned by borrow
+     */
+    void giveBack(void *region)
+    {
+        uint8_t *p = (uint8_t *)region;
+        if (p >= this->pool && p < this->pool + this->top)
+            this->top = (uint16_t)(p - this->pool);
+    }
+
+    /**
+     * @ingroup GA06
+     * @brief Releases all regions and clears the high-water mark
+     */
+    void reset()
+    {
+        this->top = this->highWater = 0;
+    }
+
+    inline uint16_t getSize() { return this->size; };                         //!< Arena size in bytes
+    inline uint16_t getUsed() { return this->top; };                          //!< Bytes currently borrowed
+    inline uint16_t getAvailable() { return this->size - this->top; };        //!< Bytes that can still be borrowed
+    inline uint16_t getHighWaterMark() { return this->highWater; };           //!< Largest amount of bytes borrowed at the same time
+};
+
+/**
+ * @ingroup GA06
+ * @brief Memory arena with static storage
+ * @details The size is a template parameter, so the storage is allocated at compile time
+ * @details (global variable) and appears in the RAM usage reported by the Arduino IDE.
+ * @code
+ * #include <KT0915_Arena.h>
+ * KT0915_StaticArena<512> arena;
+ * void setup() {
+ *    uint8_t *rssi = (uint8_t *) arena.borrow(100);
+ *    ...
+ *    arena.giveBack(rssi);
+ *    Serial.println(arena.getHighWaterMark());
+ * }
+ * @endcode
+ */
+template <uint16_t SIZE>
+class KT0915_StaticArena : public KT0915_Arena
+{
+    static_assert(SIZE > 0, "The arena size must be greater than zero");
+
+protected:
+    uint8_t storage[SIZE] __attribute__((aligned(KT0915_ARENA_ALIGN)));
+
+public:
+    KT0915_StaticArena() : KT0915_Arena(storage, SIZE) {}
+};
+
+#endif
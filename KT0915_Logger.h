@@ -0,0 +1,253 @@
+/**
+ * @brief  PU2CLR KT0915 Arduino Library - Block-aligned telemetry logger
+ * @details Collects fixed-size binary records (frequency, RSSI, SNR) into two 512-byte block buffers
+ * @details and writes whole blocks to a preallocated contiguous file (SD card). There is no file system
+ * @details call per record. While one buffer is waiting to be written, the other one keeps receiving records,
+ * @details so the radio loop only spends time on the block write (task) and never on add.
+ * @details This file does not depend on the Arduino core. On Linux, KT0915_FileBlockDevice can be used as
+ * @details the block device.
+ * @copyright Copyright (c) 2026 KT0915 library contributors.
+ */
+
+#ifndef _KT0915_LOGGER_H
+#define _KT0915_LOGGER_H
+
+#include <stdint.h>
+#include <string.h>
+#include "KT0915_Arena.h"
+
+#define KT0915_LOG_BLOCK_SIZE 512 // SD card block size
+
+/**
+ * @defgroup GA07 Telemetry logger
+ * @section  GA07 Telemetry logger
+ * @details  Block-aligned, double-buffered logging of RSSI/SNR/frequency records
+ */
+
+/**
+ * @ingroup GA07
+ * @brief Telemetry record (16 bytes, 32 records per block)
+ * @details Unused records of the last block are filled with zeros (frequency = 0).
+ */
+typedef struct
+{
+    uint32_t time;      //!< Time stamp (ms)
+    uint32_t frequency; //!< Frequency (KHz)
+    uint16_t sequence;  //!< Record sequence number (set by the logger)
+    uint8_t mode;       //!< MODE_FM or MODE_AM
+    uint8_t rssi;       //!< RSSI (see getFmRssi and getAmRssi)
+    uint8_t snr;        //!< SNR (FM only)
+    uint8_t stereo;     //!< 1 = Stereo; 0 = Mono
+    uint8_t reserved[2];
+} kt09xx_log_record;
+
+static_assert(KT0915_LOG_BLOCK_SIZE % sizeof(kt09xx_log_record) == 0, "A block must hold a whole number of records");
+
+#define KT0915_LOG_RECORDS_PER_BLOCK (KT0915_LOG_BLOCK_SIZE / sizeof(kt09xx_log_record))
+
+/**
+ * @ingroup GA07
+ * @brief Block device used by the logger
+ * @details Implement writeBlock for your storage. For an SD card, write the block straight to the card
+ * @details (for example, SdFat card()->writeBlock).
+ */
+class KT0915_BlockDevice
+{
+public:
+    /**
+     * @brief Writes one 512-byte block
+     * @param block  absolute block number
+     * @param data   KT0915_LOG_BLOCK_SIZE bytes
+     * @return true if the block was written
+     */
+    virtual bool writeBlock(uint32_t block, const uint8_t *data) = 0;
+};
+
+/**
+ * @ingroup GA07
+ * @brief Double-buffered block logger
+ * @code
+ * KT0915_StaticArena<2 * KT0915_LOG_BLOCK_SIZE> arena;
+ * KT0915_Logger logger;
+ * ...
+ * logger.begin(&device, firstBlock, blockCount, arena);
+ * ...
+ * void loop() {
+ *    logger.add(record);   // Never writes to the device
+ *    logger.task();        // Writes a full block when there is one
+ * }
+ * @endcode
+ */
+class KT0915_Logger
+{
+
+protected:
+    KT0915_BlockDevice *device = NULL;
+    uint8_t *buffer[2] = {NULL, NULL};
+    uint32_t nextBlock = 0;     //!< Next block to be written
+    uint32_t endBlock = 0;      //!< First block after the file
+    uint16_t fill = 0;          //!< Records in the active buffer
+    uint16_t sequence = 0;      //!< Next record sequence number
+    uint8_t active = 0;         //!< Buffer receiving records
+    bool pending = false;       //!< The other buffer is full and waiting to be written
+    uint32_t dropped = 0;       //!< Records lost because both buffers were full or the file was full
+
+    // Writes the buffer that is not active. records is the number of records it holds (counted as dropped on failure).
+    bool writePending(uint16_t records)
+    {
+        if (this->nextBlock >= this->endBlock || !this->device->writeBlock(this->nextBlock, this->buffer[!this->active]))
+        {
+            this->dropped += records;
+            this->pending = false;
+            return false;
+        }
+        this->nextBlock++;
+        this->pending = false;
+        return true;
+    }
+
+public:
+    /**
+     * @ingroup GA07
+     * @brief Starts the logger
+     * @param device      block device
+     * @param firstBlock  first block of the preallocated contiguous file
+     * @param blockCount  number of blocks of the file
+     * @param buffers     2 * KT0915_LOG_BLOCK_SIZE bytes
+     */
+    void begin(KT0915_BlockDevice *device, uint32_t firstBlock, uint32_t blockCount, uint8_t *buffers)
+    {
+        this->device = device;
+        this->buffer[0] = buffers;
+        this->buffer[1] = buffers + KT0915_LOG_BLOCK_SIZE;
+        this->nextBlock = firstBlock;
+        this->endBlock = firstBlock + blockCount;
+        this->fill = this->sequence = this->active = 0;
+        this->pending = false;
+        this->dropped = 0;
+    }
+
+    /**
+     * @ingroup GA07
+     * @brief Starts the logger with the block buffers borrowed from a memory arena
+     * @see KT0915_Arena
+     * @return false if the arena has not enough room
+     */
+    bool begin(KT0915_BlockDevice *device, uint32_t firstBlock, uint32_t blockCount, KT0915_Arena &arena)
+    {
+        uint8_t *buffers = (uint8_t *)arena.borrow(2 * KT0915_LOG_BLOCK_SIZE);
+        if (buffers == NULL)
+            return false;
+        begin(device, firstBlock, blockCount, buffers);
+        return true;
+    }
+
+    /**
+     * @ingroup GA07
+     * @brief Adds a record to the active buffer
+     * @details The record is copied; its sequence number is set by the logger. This method never writes to the device.
+     * @param record  record to be logged
+     * @return false if the record was dropped (both buffers full)
+     */
+    bool add(const kt09xx_log_record &record)
+    {
+        kt09xx_log_record *r;
+
+        if (this->fill == KT0915_LOG_RECORDS_PER_BLOCK)
+        {
+            if (this->pending)
+            {
+                this->dropped++;
+                return false;
+            }
+            this->active = !this->active;
+            this->pending = true;
+            this->fill = 0;
+        }
+
+        r = (kt09xx_log_record *)this->buffer[this->active] + this->fill++;
+        memcpy(r, &record, sizeof(kt09xx_log_record));
+        r->sequence = this->sequence++;
+        return true;
+    }
+
+    /**
+     * @ingroup GA07
+     * @brief Writes the full block, if there is one
+     * @details Call it from the loop. It writes at most one block per call.
+     * @return false if a block could not be written (device error or file full)
+     */
+    bool task()
+    {
+        return (this->pending) ? writePending(KT0915_LOG_RECORDS_PER_BLOCK) : true;
+    }
+
+    /**
+     * @ingroup GA07
+     * @brief Writes everything collected so far
+     * @details The last block is filled with zeros. Call it before removing the card or turning the logger off.
+     * @return false if a block could not be written
+     */
+    bool flush()
+    {
+        bool ok = task();
+        uint16_t records = this->fill;
+        if (records == 0)
+            return ok;
+
+        memset(this->buffer[this->active] + records * sizeof(kt09xx_log_record), 0, KT0915_LOG_BLOCK_SIZE - records * sizeof(kt09xx_log_record));
+        this->active = !this->active;
+        this->fill = 0;
+        return writePending(records) && ok;
+    }
+
+    inline uint32_t getDropped() { return this->dropped; };                           //!< Records lost so far
+    inline uint32_t getFreeBlocks() { return this->endBlock - this->nextBlock; };      //!< Blocks left in the file
+};
+
+#ifndef ARDUINO
+#include <stdio.h>
+
+/**
+ * @ingroup GA07
+ * @brief Block device backed by a regular file (Linux)
+ * @details Block n is stored at offset n * 512. Use it to test the logger and to read logs on a computer.
+ */
+class KT0915_FileBlockDevice : public KT0915_BlockDevice
+{
+
+protected:
+    FILE *file = NULL;
+
+public:
+    ~KT0915_FileBlockDevice() { close(); }
+
+    /**
+     * @brief Creates the file. An existing file is truncated, so blocks of an old log are not read as new records.
+     * @return true if the file is open
+     */
+    bool open(const char *path)
+    {
+        close();
+        this->file = fopen(path, "w+b");
+        return this->file != NULL;
+    }
+
+    void close()
+    {
+        if (this->file != NULL)
+            fclose(this->file);
+        this->file = NULL;
+    }
+
+    bool writeBlock(uint32_t block, const uint8_t *data)
+    {
+        return this->file != NULL &&
+               fseek(this->file, (long)block * KT0915_LOG_BLOCK_SIZE, SEEK_SET) == 0 &&
+               fwrite(data, KT0915_LOG_BLOCK_SIZE, 1, this->file) == 1 &&
+               fflush(this->file) == 0;
+    }
+};
+#endif
+
+#endif
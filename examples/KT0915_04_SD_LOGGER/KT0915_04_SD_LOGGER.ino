@@ -0,0 +1,171 @@
+/*
+   Stand-alone field logger: FM band scan with RSSI/SNR records written to an SD card.
+
+   The records (16 bytes) are collected into two 512-byte block buffers (KT0915_Logger) and written
+   as whole blocks straight to a preallocated contiguous file. There is no file system call per record.
+   The block buffers are borrowed from a static memory arena (KT0915_StaticArena).
+   The scan is pipelined: the status of a channel is read and the next channel is tuned in the same
+   I2C transaction (getStatusAndSetFrequency), and the records are logged while the next channel settles.
+
+   This sketch uses the SdFat library version 1.x by Bill Greiman (Arduino Library Manager).
+
+   Serial Monitor commands (9600 baud):
+    s - stops logging and writes the last block;
+    ? - shows the logger status.
+
+   Reading the log on a computer: the file (KT0915.BIN) is a sequence of kt09xx_log_record (see KT0915_Logger.h).
+   Records with frequency = 0 are unused.
+
+   RAM: the two block buffers take 1KB and SdFat needs about 600 bytes more (cache and file objects).
+   A 2KB board (ATmega328 - Uno, Nano, Pro Mini) is left with almost no stack. Use a board with more RAM,
+   like the Arduino Mega 2560 (8KB) below, an ESP32 or an ARM board (Teensy, STM32 etc).
+   The Mega 2560 is a 5V board: use a bidirectional level converter for the KT0915 I2C bus (see examples/README.md).
+
+   KT0915 and Arduino Mega 2560 wire up
+
+   | KT0915 pin     | Arduino pin | Description |
+   | -----------    | ----------- | ----------- |
+   | ENABLE (pin 9) |   12        | It is optional. The KT0915 pin 9 can be connected to +Vcc directly |
+   | CLK  (pin 14)  |   21 (SCL)  |             |
+   | SDA  (pin 15)  |   20 (SDA)  |             |
+
+   | SD Card        | Arduino pin |
+   | -----------    | ----------- |
+   | CS             |   53        |
+   | MOSI           |   51        |
+   | MISO           |   50        |
+   | SCK            |   52        |
+
+  PU2CLR KT0915 API documentation: https://pu2clr.github.io/KT0915/extras/docs/html/index.html
+
+  By KT0915 library contributors, 2026.
+*/
+
+#include <KT0915.h>
+#include <KT0915_Logger.h>
+#include <SdFat.h>
+
+#define RADIO_ENABLE_PIN 12     // When this pin is high, the radio becomes enable. You can set -1 to control or setup it via circuit.
+#define SD_CS_PIN 53
+
+#define LOG_FILE_NAME "KT0915.BIN"
+#define LOG_BLOCKS 20480UL      // 10MB preallocated file
+
+#define MIN_FREQUENCY 87000
+#define MAX_FREQUENCY 108000
+#define STEP 100
+#define TUNE_DELAY 15           // See the sketch KT0915_02_SETTLE_TIME
+
+// Writes the blocks straight to the card (no file system call).
+class SdBlockDevice : public KT0915_BlockDevice
+{
+public:
+  SdFat *sd;
+  bool writeBlock(uint32_t block, const uint8_t *data)
+  {
+    return sd->card()->writeBlock(block, data);
+  }
+};
+
+KT0915 radio;
+SdFat sd;
+SdFile file;
+SdBlockDevice device;
+KT0915_StaticArena<2 * KT0915_LOG_BLOCK_SIZE> arena;
+KT0915_Logger logger;
+
+bool logging = false;
+uint32_t tuneTime;
+
+void setup() {
+
+  uint32_t firstBlock, lastBlock;
+
+  Serial.begin(9600);
+  while (!Serial);
+
+  radio.setup(RADIO_ENABLE_PIN, OSCILLATOR_32KHZ, 0);
+  radio.setVolume(0);
+  radio.setFM(MIN_FREQUENCY, MAX_FREQUENCY, MIN_FREQUENCY, STEP);
+  radio.setTuneDelay(TUNE_DELAY);
+
+  if (!sd.begin(SD_CS_PIN, SD_SCK_MHZ(50))) {
+    Serial.println("SD card not found.");
+    return;
+  }
+
+  sd.remove(LOG_FILE_NAME);
+  if (!file.createContiguous(LOG_FILE_NAME, LOG_BLOCKS * KT0915_LOG_BLOCK_SIZE) || !file.contiguousRange(&firstBlock, &lastBlock)) {
+    Serial.println("Could not create the log file.");
+    return;
+  }
+
+  device.sd = &sd;
+  if (!logger.begin(&device, firstBlock, LOG_BLOCKS, arena)) {
+    Serial.println("Not enough memory.");
+    return;
+  }
+
+  logging = true;
+  tuneTime = millis();
+  Serial.println("Logging. Type s to stop or ? to status.");
+}
+
+void showStatus()
+{
+  Serial.print("\nFree blocks: ");
+  Serial.print(logger.getFreeBlocks());
+  Serial.print(" - Dropped records: ");
+  Serial.print(logger.getDropped());
+  Serial.print(" - Arena high-water mark: ");
+  Serial.println(arena.getHighWaterMark());
+}
+
+void stopLogging()
+{
+  logger.flush();
+  file.close();
+  logging = false;
+  showStatus();
+  Serial.println("Stopped. You can remove the SD card.");
+}
+
+void loop()
+{
+  kt09xx_log_record record;
+  kt09xx_status status;
+
+  if (Serial.available() > 0)
+  {
+    char key = Serial.read();
+    if (key == 's' && logging)
+      stopLogging();
+    else if (key == '?')
+      showStatus();
+  }
+
+  if (!logging)
+    return;
+
+  // Waits the rest of the tune delay. The time spent logging is part of it.
+  while ((millis() - tuneTime) < TUNE_DELAY);
+
+  // Reads the status of the tuned channel and starts tuning the next one in the same I2C transaction.
+  uint32_t tuned = radio.getFrequency();
+  radio.getStatusAndSetFrequency((tuned >= MAX_FREQUENCY) ? MIN_FREQUENCY : tuned + STEP, &status);
+  tuneTime = millis();
+
+  memset(&record, 0, sizeof(record));
+  record.time = tuneTime;
+  record.frequency = tuned;
+  record.mode = MODE_FM;
+  record.rssi = status.statusa.refined.FMRSSI * 3;
+  record.snr = status.statusc.refined.FMSNR;
+  record.stereo = (status.statusa.refined.ST == 3);
+  logger.add(record);
+
+  logger.task();
+
+  if (logger.getFreeBlocks() == 0)
+    stopLogging();
+}
@@ -23,6 +23,12 @@
    | SDA  (pin 15)  |   A4        |             |
 
 
+  Dashboard mode (type T): draws frequency, RSSI/SNR bars, stereo indicator, volume and a mini bandscope once and,
+  after that, sends only the fields that changed (ANSI escape sequences). It needs an ANSI terminal
+  (screen, minicom, PuTTY etc). The Arduino IDE Serial Monitor does not support it.
+  Type B in dashboard mode to sweep the bandscope (32 channels around the current frequency, within the band).
+  Type 0 in dashboard mode to redraw the screen.
+
   I strongly recommend starting with this sketch.
 
   See schematic: https://pu2clr.github.io/KT0915/
@@ -36,15 +42,31 @@
 
 #define RADIO_ENABLE_PIN 12    // When this pin is high, the radio becomes enable. You can set -1 to control or setup it via circuit.
 
+#define BAR_SIZE 31            // RSSI and SNR bars width
+#define SCOPE_SIZE 32          // Bandscope channels
+#define DASHBOARD_REFRESH 250  // Signal refresh time in dashboard mode (ms)
+
 uint32_t currentFM = 103900;
 uint32_t currentAM = 810;
 uint32_t currentFrequency;
 
+// Current band (bandscope limits)
+uint32_t minimumFrequency = 84000;
+uint32_t maximumFrequency = 108000;
+uint16_t currentStep = 100;
+
 KT0915 radio; 
 
 // Set your FM station frequency. Default is 107.5MHz (107500KHz)
 uint32_t fmFreq = 106500;
 
+// Dashboard mode: last values sent to the terminal
+bool dashboard = false;
+uint32_t shownFrequency;
+uint8_t shownMode, shownRssi, shownSnr, shownStereo, shownVolume;
+uint8_t scope[SCOPE_SIZE];
+uint32_t lastRefresh = 0;
+
 void setup() {
 
   Serial.begin(9600);
@@ -54,7 +76,7 @@ void setup() {
   radio.setVolume(25);
 
   currentFrequency = currentFM;
-  radio.setFM(84000, 108000, currentFrequency, 100);
+  radio.setFM(minimumFrequency, maximumFrequency, currentFrequency, currentStep);
   showHelp();
   showStatus();
 }
@@ -69,6 +91,7 @@ void showHelp()
   Serial.println("Type S or s to seek station Up or Down");
   Serial.println("Type + or - to volume Up or Down");
   Serial.println("Type 0 to show current status");
+  Serial.println("Type T to dashboard mode (ANSI terminal) and B to bandscope");
   Serial.println("Type ? to this help.");
   Serial.println("==================================================");
   delay(1000);
@@ -92,6 +115,191 @@ void showStatus()
   // Serial.print(radio.getVolume());
 }
 
+/*
+   Dashboard mode
+   Each field is drawn at a fixed position. After the first draw, only the fields that changed are sent.
+*/
+
+// Moves the cursor to row, col (1-based)
+void moveTo(uint8_t row, uint8_t col)
+{
+  Serial.print("\e[");
+  Serial.print(row);
+  Serial.print(';');
+  Serial.print(col);
+  Serial.print('H');
+}
+
+void showDashboardFrequency()
+{
+  uint32_t freq = radio.getFrequency();
+
+  moveTo(1, 12);
+  if (radio.getCurrentMode() == MODE_FM)
+  {
+    Serial.print(freq / 1000);
+    Serial.print('.');
+    if ((freq % 1000) / 10 < 10) Serial.print('0');
+    Serial.print((freq % 1000) / 10);
+    Serial.print(" MHz FM ");
+  }
+  else
+  {
+    Serial.print(freq);
+    Serial.print(" kHz AM   ");
+  }
+  shownFrequency = freq;
+  shownMode = radio.getCurrentMode();
+}
+
+// Draws only the cells between the old and the new bar size.
+void showBar(uint8_t row, uint8_t value, uint8_t shown)
+{
+  if (value > BAR_SIZE) value = BAR_SIZE;
+  if (shown > BAR_SIZE) shown = BAR_SIZE;
+  if (value == shown)
+    return;
+
+  moveTo(row, 8 + min(value, shown));
+  for (uint8_t i = min(value, shown); i < max(value, shown); i++)
+    Serial.print((i < value) ? '#' : '.');
+}
+
+// Prints the value right aligned in a 3 character field
+void showNumber(uint8_t row, uint8_t col, uint8_t value)
+{
+  moveTo(row, col);
+  if (value < 100) Serial.print(' ');
+  if (value < 10) Serial.print(' ');
+  Serial.print(value);
+}
+
+void showDashboardSignal()
+{
+  uint8_t rssi, snr, stereo;
+
+  // Raw readings: RSSI 0 to 93 (3 per bar cell); SNR 0 to 127 (4 per bar cell)
+  if (radio.getCurrentMode() == MODE_FM)
+  {
+    rssi = radio.getFmRssi();
+    snr = radio.getFmSnr();
+    stereo = radio.isFmStereo();
+  }
+  else
+  {
+    rssi = radio.getAmRssi();
+    snr = 0;
+    stereo = 0;
+  }
+
+  if (rssi != shownRssi)
+  {
+    showBar(2, rssi / 3, shownRssi / 3);
+    showNumber(2, 41, rssi);
+    shownRssi = rssi;
+  }
+  if (snr != shownSnr)
+  {
+    showBar(3, snr / 4, shownSnr / 4);
+    showNumber(3, 41, snr);
+    shownSnr = snr;
+  }
+  if (stereo != shownStereo)
+  {
+    moveTo(4, 1);
+    Serial.print((stereo) ? "STEREO" : "MONO  ");
+    shownStereo = stereo;
+  }
+}
+
+void showDashboardVolume()
+{
+  showNumber(4, 20, radio.getVolume());
+  shownVolume = radio.getVolume();
+}
+
+// Sweeps SCOPE_SIZE channels around the current frequency (within the band) and draws only the changed cells.
+void showBandscope()
+{
+  const char level[] = " .:-=+*#%@";
+  uint32_t freq = radio.getFrequency();
+  uint32_t span = (uint32_t) (SCOPE_SIZE - 1) * currentStep;
+  uint32_t first = minimumFrequency;
+  uint16_t tuneDelay = radio.getTuneDelay();
+
+  // Centers the scope on the current frequency, but keeps it inside the band limits.
+  if (freq > minimumFrequency + (SCOPE_SIZE / 2) * currentStep)
+    first = freq - (SCOPE_SIZE / 2) * currentStep;
+  if (first + span > maximumFrequency)
+    first = (maximumFrequency - minimumFrequency > span) ? maximumFrequency - span : minimumFrequency;
+
+  radio.setTuneDelay(10);
+  for (uint8_t i = 0; i < SCOPE_SIZE; i++)
+  {
+    uint32_t f = first + (uint32_t) i * currentStep;
+    uint8_t cell = ' ';
+    if (f <= maximumFrequency)
+    {
+      radio.setFrequency(f);
+      int rssi = (radio.getCurrentMode() == MODE_FM) ? radio.getFmRssi() : radio.getAmRssi();
+      cell = level[rssi * 9 / 93];
+    }
+    if (cell != scope[i])
+    {
+      moveTo(5, 8 + i);
+      Serial.print((char) cell);
+      scope[i] = cell;
+    }
+  }
+  radio.setTuneDelay(tuneDelay);
+  radio.setFrequency(freq);
+}
+
+// Draws the whole dashboard (labels and all fields)
+void startDashboard()
+{
+  dashboard = true;
+  memset(scope, ' ', SCOPE_SIZE);
+
+  Serial.print("\e[?25l\e[2J");
+  moveTo(1, 1); Serial.print("Frequency:");
+  moveTo(2, 1); Serial.print("RSSI  [");
+  moveTo(3, 1); Serial.print("SNR   [");
+  for (uint8_t row = 2; row <= 3; row++)
+  {
+    moveTo(row, 8);
+    for (uint8_t i = 0; i < BAR_SIZE; i++) Serial.print('.');
+    Serial.print("]    dB");
+  }
+  moveTo(4, 13); Serial.print("Volume:");
+  moveTo(5, 1); Serial.print("Scope [");
+  moveTo(5, 8 + SCOPE_SIZE); Serial.print(']');
+  moveTo(7, 1); Serial.print("U/D: frequency  +/-: volume  A/F: band  B: bandscope  0: redraw  T: exit");
+
+  shownRssi = shownSnr = shownStereo = 0xFF;   // Forces the first draw
+  showDashboardFrequency();
+  showDashboardSignal();
+  showDashboardVolume();
+}
+
+void stopDashboard()
+{
+  dashboard = false;
+  Serial.print("\e[2J\e[H\e[?25h");
+  showHelp();
+}
+
+// Sends only the fields that changed
+void updateDashboard()
+{
+  if (radio.getFrequency() != shownFrequency || radio.getCurrentMode() != shownMode)
+    showDashboardFrequency();
+  if (radio.getVolume() != shownVolume)
+    showDashboardVolume();
+  showDashboardSignal();
+  lastRefresh = millis();
+}
+
 void loop()
 {
 
@@ -108,13 +316,21 @@ void loop()
       break;
     case 'a':
     case 'A':
-      currentFM = currentFrequency;
-      radio.setAM(550, 1710, currentAM, 10);
+      if (radio.getCurrentMode() == MODE_FM)
+        currentFM = radio.getFrequency();
+      minimumFrequency = 550;
+      maximumFrequency = 1710;
+      currentStep = 10;
+      radio.setAM(minimumFrequency, maximumFrequency, currentAM, currentStep);
       break;
     case 'f':
     case 'F':
-      currentAM = currentFrequency;
-      radio.setFM(87000, 108000, currentFM, 100);
+      if (radio.getCurrentMode() == MODE_AM)
+        currentAM = radio.getFrequency();
+      minimumFrequency = 87000;
+      maximumFrequency = 108000;
+      currentStep = 100;
+      radio.setFM(minimumFrequency, maximumFrequency, currentFM, currentStep);
       break;
     case 'U':
     case 'u':
@@ -131,14 +347,35 @@ void loop()
       // radio.seekStation(0);
       break;
     case '0':
-      showStatus();
+      if (dashboard)
+        startDashboard();   // Redraws the whole screen
+      else
+        showStatus();
       break;
     case '?':
-      showHelp();
+      if (!dashboard) showHelp();
+      break;
+    case 'T':
+    case 't':
+      if (dashboard)
+        stopDashboard();
+      else
+        startDashboard();
+      break;
+    case 'B':
+    case 'b':
+      if (dashboard) showBandscope();
       break;
     default:
       break;
     }
-    showStatus();
+    if (dashboard)
+      updateDashboard();
+    else
+      showStatus();
+  }
+  else if (dashboard && (millis() - lastRefresh) > DASHBOARD_REFRESH)
+  {
+    updateDashboard();
   }
 }
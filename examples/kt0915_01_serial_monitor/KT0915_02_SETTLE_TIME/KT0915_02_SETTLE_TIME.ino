@@ -0,0 +1,185 @@
+/*
+   Settle time versus accuracy characterization for the PU2CLR KT0915 Arduino Library.
+
+   This sketch helps you to choose the shortest safe tune wait time (setTuneDelay) for your circuit.
+   For each band, it tunes the reference stations listed below and reads RSSI and SNR at increasing delays
+   after the tune command. Each reading is compared with a reference value taken after a long dwell.
+   The result is a table (CSV) of error versus delay that you can copy from the Serial Monitor to a spreadsheet.
+
+   How to use:
+    1) Replace the reference stations below by strong and weak stations you can receive in your location;
+    2) Upload the sketch and open the Serial Monitor at 9600 baud;
+    3) Choose the shortest delay where the errors become stable. Use it with radio.setTuneDelay().
+
+   Output columns:
+    band, delay_ms, rssi_ms, snr_ms, rssi_err_avg, rssi_err_max, snr_err_avg, snr_err_max
+
+   delay_ms is the value given to setTuneDelay. rssi_ms and snr_ms are the measured times (average) from the
+   tune command to the end of the RSSI and SNR readings. During the sweep, the wait time after each register
+   access (setRegisterDelay) is set to SWEEP_REGISTER_DELAY_US, so the readings are taken right after the tune delay.
+   The SNR columns are 0 for AM bands (the KT0915 does not provide SNR in AM mode).
+
+   KT0915 and Arduino Pro Mini wire up
+
+   | KT0915 pin     | Arduino pin | Description |
+   | -----------    | ----------- | ----------- |
+   | ENABLE (pin 9) |   12        | It is optional. The KT0915 pin 9 can be connected to +Vcc directly |
+   | CLK  (pin 14)  |   A5        |             |
+   | SDA  (pin 15)  |   A4        |             |
+
+  PU2CLR KT0915 API documentation: https://pu2clr.github.io/KT0915/extras/docs/html/index.html
+
+  By KT0915 library contributors, 2026.
+*/
+
+#include <KT0915.h>
+
+#define RADIO_ENABLE_PIN 12     // When this pin is high, the radio becomes enable. You can set -1 to control or setup it via circuit.
+
+#define REGISTER_DELAY_US 6000  // Wait time after each register access (library default). Used for the reference values.
+#define SWEEP_REGISTER_DELAY_US 0 // Wait time after each register access during the sweep.
+#define REFERENCE_DWELL   500   // Long dwell used to get the reference values (ms).
+#define READINGS          4     // Number of readings averaged for the reference values.
+#define MAX_STATIONS      4
+
+typedef struct
+{
+  const char *name;
+  uint8_t mode;
+  uint32_t minimumFrequency;
+  uint32_t maximumFrequency;
+  uint16_t step;
+  uint32_t station[MAX_STATIONS];   // Reference stations. Use 0 for unused positions.
+} Band;
+
+// Replace the stations below by stations you can receive in your location.
+Band band[] = {
+  {"FM", MODE_FM, 84000, 108000, 100, {89900, 94500, 103900, 106500}},
+  {"MW", MODE_AM, 520, 1710, 10, {570, 810, 1140, 0}},
+  {"SW", MODE_AM, 5900, 15800, 5, {6000, 9650, 11780, 0}}
+};
+
+const int lastBand = (sizeof band / sizeof(Band)) - 1;
+
+// Delays (ms) after the tune command.
+const uint16_t tuneDelays[] = {0, 1, 2, 5, 10, 15, 20, 30, 50, 80};
+const int lastDelay = (sizeof tuneDelays / sizeof(uint16_t)) - 1;
+
+KT0915 radio;
+
+void setup() {
+
+  Serial.begin(9600);
+  while (!Serial);
+
+  radio.setup(RADIO_ENABLE_PIN, OSCILLATOR_32KHZ, 0);
+  radio.setVolume(0);
+  radio.setRegisterDelay(REGISTER_DELAY_US);
+
+  Serial.println("band,delay_ms,rssi_ms,snr_ms,rssi_err_avg,rssi_err_max,snr_err_avg,snr_err_max");
+
+  for (int i = 0; i <= lastBand; i++)
+    characterizeBand(band[i]);
+
+  Serial.println("Done.");
+}
+
+int getRssi(uint8_t mode)
+{
+  return (mode == MODE_FM) ? radio.getFmRssi() : radio.getAmRssi();
+}
+
+int getSnr(uint8_t mode)
+{
+  return (mode == MODE_FM) ? radio.getFmSnr() : 0;
+}
+
+// Tunes to the band limit (far from the station) so the next tune always starts from the same condition.
+void detune(Band &b, uint32_t station)
+{
+  radio.setTuneDelay(REFERENCE_DWELL);
+  radio.setFrequency((station == b.minimumFrequency) ? b.maximumFrequency : b.minimumFrequency);
+}
+
+void characterizeBand(Band &b)
+{
+  int refRssi[MAX_STATIONS];
+  int refSnr[MAX_STATIONS];
+  int n;
+
+  radio.setTuneDelay(REFERENCE_DWELL);
+  if (b.mode == MODE_FM)
+    radio.setFM(b.minimumFrequency, b.maximumFrequency, b.minimumFrequency, b.step);
+  else
+    radio.setAM(b.minimumFrequency, b.maximumFrequency, b.minimumFrequency, b.step);
+
+  // Reference values (long dwell)
+  for (n = 0; n < MAX_STATIONS && b.station[n] != 0; n++)
+  {
+    radio.setTuneDelay(REFERENCE_DWELL);
+    radio.setFrequency(b.station[n]);
+    refRssi[n] = refSnr[n] = 0;
+    for (int r = 0; r < READINGS; r++)
+    {
+      refRssi[n] += getRssi(b.mode);
+      refSnr[n] += getSnr(b.mode);
+    }
+    refRssi[n] /= READINGS;
+    refSnr[n] /= READINGS;
+  }
+
+  if (n == 0)
+    return;
+
+  // Error versus delay
+  for (int d = 0; d <= lastDelay; d++)
+  {
+    int rssiErrSum = 0, rssiErrMax = 0;
+    int snrErrSum = 0, snrErrMax = 0;
+    uint32_t rssiTime = 0, snrTime = 0;
+
+    for (int s = 0; s < n; s++)
+    {
+      detune(b, b.station[s]);
+      radio.setRegisterDelay(SWEEP_REGISTER_DELAY_US);
+      radio.setTuneDelay(tuneDelays[d]);
+
+      uint32_t start = micros();
+      radio.setFrequency(b.station[s]);
+      int rssi = getRssi(b.mode);
+      rssiTime += micros() - start;
+      int snr = getSnr(b.mode);
+      snrTime += micros() - start;
+
+      radio.setRegisterDelay(REGISTER_DELAY_US);
+
+      int rssiErr = abs(rssi - refRssi[s]);
+      int snrErr = abs(snr - refSnr[s]);
+
+      rssiErrSum += rssiErr;
+      snrErrSum += snrErr;
+      if (rssiErr > rssiErrMax) rssiErrMax = rssiErr;
+      if (snrErr > snrErrMax) snrErrMax = snrErr;
+    }
+
+    Serial.print(b.name);
+    Serial.print(',');
+    Serial.print(tuneDelays[d]);
+    Serial.print(',');
+    Serial.print(rssiTime / 1000.0 / n);
+    Serial.print(',');
+    Serial.print((b.mode == MODE_FM) ? snrTime / 1000.0 / n : 0.0);
+    Serial.print(',');
+    Serial.print((float) rssiErrSum / n);
+    Serial.print(',');
+    Serial.print(rssiErrMax);
+    Serial.print(',');
+    Serial.print((float) snrErrSum / n);
+    Serial.print(',');
+    Serial.println(snrErrMax);
+  }
+}
+
+void loop()
+{
+}
@@ -0,0 +1,74 @@
+/*
+   Boot image helper for the PU2CLR KT0915 Arduino Library.
+
+   A boot image (kt0915BootImage and applyBootImage) changes only the register bits set by the configuration.
+   All other bits (reserved, anti-pop, blend, audio gain, key mode etc) keep the power on values of the device.
+   This sketch reads these values once (getBootBase) and prints them as a kt09xx_boot_base initializer.
+   Copy the printed line to your sketch and build the image with it:
+
+     constexpr kt09xx_boot_base bootBase = {...};   // Printed by this sketch
+     constexpr kt09xx_boot_config bootConfig = {MODE_FM, 84000, 108000, 103900, 100, 1, 0, OSCILLATOR_32KHZ, REF_CLOCK_DISABLE, 25, DE_EMPHASIS_75, 1, 1};
+     const kt09xx_boot_image bootImage PROGMEM = kt0915BootImage(bootConfig, bootBase);
+     ...
+     radio.applyBootImage(RADIO_ENABLE_PIN, &bootImage);
+
+   The values must be read right after the device is powered on. Reset the Arduino and the KT0915 together
+   (power cycle) before running this sketch.
+
+   KT0915 and Arduino Pro Mini wire up
+
+   | KT0915 pin     | Arduino pin | Description |
+   | -----------    | ----------- | ----------- |
+   | ENABLE (pin 9) |   12        | It is optional. The KT0915 pin 9 can be connected to +Vcc directly |
+   | CLK  (pin 14)  |   A5        |             |
+   | SDA  (pin 15)  |   A4        |             |
+
+  PU2CLR KT0915 API documentation: https://pu2clr.github.io/KT0915/extras/docs/html/index.html
+
+  By KT0915 library contributors, 2026.
+*/
+
+#include <KT0915.h>
+
+#define RADIO_ENABLE_PIN 12     // When this pin is high, the radio becomes enable. You can set -1 to control or setup it via circuit.
+
+KT0915 radio;
+
+void printHex(uint16_t value)
+{
+  Serial.print("0x");
+  for (int8_t shift = 12; shift >= 0; shift -= 4)
+    Serial.print((value >> shift) & 0xF, HEX);
+}
+
+void setup()
+{
+  kt09xx_boot_base base;
+
+  Serial.begin(9600);
+  while (!Serial);
+
+  radio.getBootBase(RADIO_ENABLE_PIN, &base);
+
+  Serial.print("\nconstexpr kt09xx_boot_base bootBase = {");
+  printHex(base.amsyscfg);
+  Serial.print(", ");
+  printHex(base.seek);
+  Serial.print(", ");
+  printHex(base.volume);
+  Serial.print(", ");
+  printHex(base.dspcfga);
+  Serial.print(", ");
+  printHex(base.locfga);
+  Serial.print(", ");
+  printHex(base.locfgc);
+  Serial.print(", ");
+  printHex(base.amcfg);
+  Serial.print(", ");
+  printHex(base.rxcfg);
+  Serial.println("};");
+}
+
+void loop()
+{
+}
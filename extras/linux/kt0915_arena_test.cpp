@@ -0,0 +1,120 @@
+/*
+ * Host test for KT0915_Arena (KT0915_Arena.h).
+ *
+ * It checks: borrow and giveBack in stack order, NULL when the arena has not enough room
+ * (including sizes near 65535) and the high-water mark.
+ *
+ * Build and run:
+ *   g++ -std=c++11 -O2 -I../.. -o kt0915_arena_test kt0915_arena_test.cpp && ./kt0915_arena_test
+ *
+ * Copyright (c) 2026 KT0915 library contributors.
+ * This program can be freely distributed using the MIT Free Software model.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include "KT0915_Arena.h"
+
+#define ARENA_SIZE KT0915_ARENA_BYTES(uint8_t, 256)
+
+static int failures = 0;
+
+#define CHECK(condition)                                                  \
+    do                                                                    \
+    {                                                                     \
+        if (!(condition))                                                 \
+        {                                                                 \
+            fprintf(stderr, "%s:%d: FAILED: %s\n", __FILE__, __LINE__, #condition); \
+            failures++;                                                   \
+        }                                                                 \
+    } while (0)
+
+// Regions are aligned and follow each other; giveBack releases the region and the ones borrowed after it.
+static void testStackOrder()
+{
+    KT0915_StaticArena<ARENA_SIZE> arena;
+    uint8_t *a, *b, *c;
+
+    a = (uint8_t *)arena.borrow(10);
+    b = (uint8_t *)arena.borrow(20);
+    c = (uint8_t *)arena.borrow(1);
+    CHECK(a != NULL && b != NULL && c != NULL);
+    CHECK((uintptr_t)a % KT0915_ARENA_ALIGN == 0 && (uintptr_t)b % KT0915_ARENA_ALIGN == 0 && (uintptr_t)c % KT0915_ARENA_ALIGN == 0);
+    CHECK(b == a + KT0915_ARENA_BYTES(uint8_t, 10));
+    CHECK(c == b + KT0915_ARENA_BYTES(uint8_t, 20));
+    CHECK(arena.getUsed() == KT0915_ARENA_BYTES(uint8_t, 10) + KT0915_ARENA_BYTES(uint8_t, 20) + KT0915_ARENA_BYTES(uint8_t, 1));
+
+    arena.giveBack(c);
+    CHECK(arena.getUsed() == KT0915_ARENA_BYTES(uint8_t, 10) + KT0915_ARENA_BYTES(uint8_t, 20));
+    CHECK(arena.borrow(1) == c); // The same region is borrowed again
+
+    arena.giveBack(b); // Releases b and c
+    CHECK(arena.getUsed() == KT0915_ARENA_BYTES(uint8_t, 10));
+    arena.giveBack(a);
+    CHECK(arena.getUsed() == 0);
+    CHECK(arena.getAvailable() == ARENA_SIZE);
+
+    arena.giveBack(NULL);        // Not a region of the arena: ignored
+    arena.giveBack(a + ARENA_SIZE);
+    CHECK(arena.getUsed() == 0);
+}
+
+// A request that does not fit returns NULL and does not change the arena.
+static void testOverflow()
+{
+    KT0915_StaticArena<ARENA_SIZE> arena;
+    void *all;
+
+    CHECK(arena.borrow(ARENA_SIZE + 1) == NULL);
+    CHECK(arena.borrow(65535) == NULL); // Rounded size does not fit in 16 bits
+    CHECK(arena.borrow(65534) == NULL);
+    CHECK(arena.getUsed() == 0);
+
+    all = arena.borrow(ARENA_SIZE); // Exact fill
+    CHECK(all != NULL);
+    CHECK(arena.getAvailable() == 0);
+    CHECK(arena.borrow(1) == NULL);
+    CHECK(arena.getUsed() == ARENA_SIZE);
+
+    arena.giveBack(all);
+    CHECK(arena.borrow(ARENA_SIZE) == all);
+}
+
+// The high-water mark keeps the largest amount borrowed until reset.
+static void testHighWaterMark()
+{
+    KT0915_StaticArena<ARENA_SIZE> arena;
+    void *a, *b;
+
+    CHECK(arena.getHighWaterMark() == 0);
+    a = arena.borrow(100);
+    b = arena.borrow(50);
+    arena.giveBack(b);
+    arena.giveBack(a);
+    CHECK(arena.getUsed() == 0);
+    CHECK(arena.getHighWaterMark() == KT0915_ARENA_BYTES(uint8_t, 100) + KT0915_ARENA_BYTES(uint8_t, 50));
+
+    a = arena.borrow(10);
+    CHECK(arena.getHighWaterMark() == KT0915_ARENA_BYTES(uint8_t, 100) + KT0915_ARENA_BYTES(uint8_t, 50));
+    arena.giveBack(a);
+
+    arena.reset();
+    CHECK(arena.getUsed() == 0 && arena.getHighWaterMark() == 0);
+    arena.borrow(1);
+    CHECK(arena.getHighWaterMark() == KT0915_ARENA_BYTES(uint8_t, 1));
+}
+
+int main()
+{
+    testStackOrder();
+    testOverflow();
+    testHighWaterMark();
+
+    if (failures != 0)
+    {
+        fprintf(stderr, "%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("All arena tests passed\n");
+    return 0;
+}
@@ -0,0 +1,203 @@
+/*
+ * Host test for KT0915_Logger (KT0915_Logger.h) with KT0915_FileBlockDevice.
+ *
+ * It checks: filling a block, buffer swap, records dropped while both buffers are full,
+ * records dropped when the file is full, flush of the last (partial) block and file truncation.
+ *
+ * Build and run:
+ *   g++ -std=c++11 -O2 -I../.. -o kt0915_logger_test kt0915_logger_test.cpp && ./kt0915_logger_test
+ *
+ * Copyright (c) 2026 KT0915 library contributors.
+ * This program can be freely distributed using the MIT Free Software model.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "KT0915_Logger.h"
+
+#define PER_BLOCK ((uint32_t)KT0915_LOG_RECORDS_PER_BLOCK)
+
+static int failures = 0;
+
+#define CHECK(condition)                                                  \
+    do                                                                    \
+    {                                                                     \
+        if (!(condition))                                                 \
+        {                                                                 \
+            fprintf(stderr, "%s:%d: FAILED: %s\n", __FILE__, __LINE__, #condition); \
+            failures++;                                                   \
+        }                                                                 \
+    } while (0)
+
+static kt09xx_log_record makeRecord(uint32_t n)
+{
+    kt09xx_log_record r;
+    memset(&r, 0, sizeof(r));
+    r.time = n;
+    r.frequency = 87000 + n;
+    r.mode = 0;
+    r.rssi = (uint8_t)n;
+    return r;
+}
+
+static long fileSize(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    long size;
+    if (f == NULL)
+        return -1;
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fclose(f);
+    return size;
+}
+
+static bool readRecord(const char *path, uint32_t index, kt09xx_log_record *r)
+{
+    FILE *f = fopen(path, "rb");
+    bool ok = f != NULL && fseek(f, (long)index * sizeof(kt09xx_log_record), SEEK_SET) == 0 &&
+              fread(r, sizeof(kt09xx_log_record), 1, f) == 1;
+    if (f != NULL)
+        fclose(f);
+    return ok;
+}
+
+// A file left by an old, longer log must not show up in the new one.
+static void testTruncate(const char *path)
+{
+    KT0915_FileBlockDevice device;
+    uint8_t junk[KT0915_LOG_BLOCK_SIZE];
+    FILE *f = fopen(path, "wb");
+
+    memset(junk, 0xA5, sizeof(junk));
+    for (int i = 0; i < 8; i++)
+        fwrite(junk, sizeof(junk), 1, f);
+    fclose(f);
+
+    CHECK(device.open(path));
+    device.close();
+    CHECK(fileSize(path) == 0);
+}
+
+// Fill, swap, task and flush of a partial block.
+static void testFillSwapFlush(const char *path)
+{
+    KT0915_FileBlockDevice device;
+    KT0915_StaticArena<2 * KT0915_LOG_BLOCK_SIZE> arena;
+    KT0915_Logger logger;
+    kt09xx_log_record r;
+    uint32_t n;
+
+    CHECK(device.open(path));
+    CHECK(logger.begin(&device, 0, 4, arena));
+    CHECK(arena.getAvailable() == 0);
+
+    // A full block is written only after the swap (next add) and task.
+    for (n = 0; n < PER_BLOCK; n++)
+        CHECK(logger.add(makeRecord(n)));
+    CHECK(logger.getFreeBlocks() == 4);
+    CHECK(logger.task());
+    CHECK(logger.getFreeBlocks() == 4);
+
+    CHECK(logger.add(makeRecord(n++)));
+    CHECK(logger.task());
+    CHECK(logger.getFreeBlocks() == 3);
+
+    // Partial block
+    for (; n < PER_BLOCK + 10; n++)
+        CHECK(logger.add(makeRecord(n)));
+    CHECK(logger.flush());
+    CHECK(logger.getFreeBlocks() == 2);
+    CHECK(logger.getDropped() == 0);
+    device.close();
+
+    CHECK(fileSize(path) == 2 * KT0915_LOG_BLOCK_SIZE);
+    for (uint32_t i = 0; i < PER_BLOCK + 10; i++)
+    {
+        CHECK(readRecord(path, i, &r));
+        CHECK(r.frequency == 87000 + i && r.sequence == (uint16_t)i);
+    }
+    CHECK(readRecord(path, PER_BLOCK + 10, &r) && r.frequency == 0); // Zero filled
+    CHECK(readRecord(path, 2 * PER_BLOCK - 1, &r) && r.frequency == 0);
+}
+
+// Records added while both buffers are full are dropped (task not called).
+static void testDropWhenBuffersFull(const char *path)
+{
+    KT0915_FileBlockDevice device;
+    uint8_t buffers[2 * KT0915_LOG_BLOCK_SIZE];
+    KT0915_Logger logger;
+    kt09xx_log_record r;
+    uint32_t n;
+
+    CHECK(device.open(path));
+    logger.begin(&device, 0, 8, buffers);
+
+    for (n = 0; n < 2 * PER_BLOCK; n++)
+        CHECK(logger.add(makeRecord(n)));
+    for (int i = 0; i < 5; i++)
+        CHECK(!logger.add(makeRecord(1000)));
+    CHECK(logger.getDropped() == 5);
+
+    CHECK(logger.flush());
+    CHECK(logger.getDropped() == 5);
+    CHECK(logger.getFreeBlocks() == 6);
+    device.close();
+
+    CHECK(readRecord(path, 2 * PER_BLOCK - 1, &r) && r.frequency == 87000 + 2 * PER_BLOCK - 1);
+}
+
+// Only the records that were really lost are counted when the file is full.
+static void testDropWhenFileFull(const char *path)
+{
+    KT0915_FileBlockDevice device;
+    uint8_t buffers[2 * KT0915_LOG_BLOCK_SIZE];
+    KT0915_Logger logger;
+    const uint32_t total = 200;
+    uint32_t n;
+
+    CHECK(device.open(path));
+    logger.begin(&device, 0, 4, buffers);
+
+    for (n = 0; n < total; n++)
+    {
+        logger.add(makeRecord(n));
+        logger.task();
+    }
+    logger.flush();
+    device.close();
+
+    CHECK(logger.getFreeBlocks() == 0);
+    CHECK(logger.getDropped() == total - 4 * PER_BLOCK);
+    CHECK(fileSize(path) == 4 * KT0915_LOG_BLOCK_SIZE);
+}
+
+int main()
+{
+    char path[] = "/tmp/kt0915_logger_testXXXXXX";
+    int fd = mkstemp(path);
+
+    if (fd < 0)
+    {
+        perror("mkstemp");
+        return 1;
+    }
+    close(fd);
+
+    testTruncate(path);
+    testFillSwapFlush(path);
+    testDropWhenBuffersFull(path);
+    testDropWhenFileFull(path);
+
+    unlink(path);
+
+    if (failures != 0)
+    {
+        fprintf(stderr, "%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("All logger tests passed\n");
+    return 0;
+}
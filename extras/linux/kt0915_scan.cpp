@@ -0,0 +1,525 @@
+/**
+ * @brief  PU2CLR KT0915 - Multi-bus scan scheduler for Linux
+ * @details Scans band ranges with several KT0915 devices connected to Linux I2C buses (/dev/i2c-N).
+ * @details The bands are split into chunks of channels. Each tuner has a worker thread and a queue of chunks.
+ * @details A worker that runs out of chunks steals from the tuner with the most chunks left, so the sweep time
+ * @details depends on the number of tuners and not on the slowest one. The results are merged and printed
+ * @details as CSV ordered by band and frequency.
+ * @details Tuners on the same bus share the bus only during the I2C transfers, not during the tune wait.
+ * @details When a tuner fails, the channels left in its chunk go to a retry queue shared by all workers.
+ * @details A chunk is not given again to the tuner that failed it while another tuner is still working.
+ * @details A tuner that fails MAX_TUNER_FAILURES times in a row is retired.
+ * @details See README.md in this folder.
+ * @copyright Copyright (c) 2026 KT0915 library contributors.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Same values used by the Arduino library (see KT0915.h)
+#define KT0915_I2C_ADDRESS 0x35
+#define MODE_FM 0
+#define MODE_AM 1
+#define REG_TUNE 0x03
+#define REG_STATUSA 0x12
+#define REG_STATUSC 0x14
+#define REG_AMSYSCFG 0x16
+#define REG_AMCHAN 0x17
+#define REG_AMSTATUSA 0x24
+
+#define MAX_TUNER_FAILURES 3    // Consecutive failures before a tuner is retired
+#define MAX_CHANNEL_ATTEMPTS 3  // Tune or status read failures (on any tuner) before a channel is skipped
+
+typedef struct
+{
+    uint8_t mode;
+    uint32_t minimumFrequency;
+    uint32_t maximumFrequency;
+    uint16_t step;
+} Band;
+
+typedef struct
+{
+    uint16_t band;           // Index in the band list
+    uint32_t firstFrequency;
+    uint16_t count;          // Number of channels
+    uint8_t attempts;        // Tune or status read failures on the first channel
+    int16_t failedTuner;     // Tuner that gave the chunk back (-1 = none)
+} Chunk;
+
+typedef struct
+{
+    uint16_t band;
+    uint32_t frequency;
+    int rssi;
+    int snr;
+    uint16_t tuner;
+} Result;
+
+/**
+ * @brief KT0915 connected to a Linux I2C bus
+ */
+class Tuner
+{
+
+protected:
+    int fd = -1;
+    int deviceAddress;
+    std::mutex *busLock;
+    int currentMode = -1;
+
+    bool transfer(struct i2c_msg *msgs, int count)
+    {
+        struct i2c_rdwr_ioctl_data data = {msgs, (uint32_t)count};
+        std::lock_guard<std::mutex> guard(*busLock);
+        return ioctl(this->fd, I2C_RDWR, &data) == count;
+    }
+
+public:
+    std::string busName;
+    uint16_t index;
+
+    int getAddress() { return this->deviceAddress; }
+
+    Tuner(const std::string &bus, int address, std::mutex *lock, uint16_t index) : deviceAddress(address), busLock(lock), busName(bus), index(index) {}
+    ~Tuner() { if (this->fd >= 0) close(this->fd); }
+
+    bool open()
+    {
+        this->fd = ::open(this->busName.c_str(), O_RDWR);
+        return this->fd >= 0;
+    }
+
+    bool setRegister(uint8_t reg, uint16_t parameter)
+    {
+        uint8_t buf[3] = {reg, (uint8_t)(parameter >> 8), (uint8_t)parameter};
+        struct i2c_msg msg = {(uint16_t)this->deviceAddress, 0, 3, buf};
+        return transfer(&msg, 1);
+    }
+
+    // Register address and data in a single transaction (repeated start)
+    bool getRegister(uint8_t reg, uint16_t *value)
+    {
+        uint8_t buf[2];
+        struct i2c_msg msgs[2] = {{(uint16_t)this->deviceAddress, 0, 1, &reg},
+                                  {(uint16_t)this->deviceAddress, I2C_M_RD, 2, buf}};
+        if (!transfer(msgs, 2))
+            return false;
+        *value = (uint16_t)(buf[0] << 8 | buf[1]);
+        return true;
+    }
+
+    // Sets AM_FM bit (AMSYSCFG<15>) when the mode changes
+    bool setMode(uint8_t mode)
+    {
+        uint16_t reg;
+        if (this->currentMode == mode)
+            return true;
+        if (!getRegister(REG_AMSYSCFG, &reg))
+            return false;
+        reg = (mode == MODE_AM) ? (reg | 0x8000) : (reg & 0x7FFF);
+        if (!setRegister(REG_AMSYSCFG, reg))
+            return false;
+        this->currentMode = mode;
+        return true;
+    }
+
+    bool setFrequency(uint8_t mode, uint32_t frequency)
+    {
+        if (mode == MODE_AM)
+            return setRegister(REG_AMCHAN, (uint16_t)(0x8000 | (frequency & 0x7FFF)));
+        return setRegister(REG_TUNE, (uint16_t)(0x8000 | ((frequency / 50) & 0x0FFF)));
+    }
+
+    // RSSI as returned by getFmRssi/getAmRssi; SNR as getFmSnr (0 in AM mode)
+    bool getSignal(uint8_t mode, int *rssi, int *snr)
+    {
+        uint16_t reg;
+        if (mode == MODE_AM)
+        {
+            *snr = 0;
+            if (!getRegister(REG_AMSTATUSA, &reg))
+                return false;
+            *rssi = ((reg >> 8) & 0x1F) * 3;
+            return true;
+        }
+        if (!getRegister(REG_STATUSA, &reg))
+            return false;
+        *rssi = ((reg >> 3) & 0x1F) * 3;
+        if (!getRegister(REG_STATUSC, &reg))
+            return false;
+        *snr = (reg >> 6) & 0x7F;
+        return true;
+    }
+};
+
+/**
+ * @brief Chunk queues and worker threads
+ */
+class Scheduler
+{
+
+protected:
+    struct Queue
+    {
+        std::mutex lock;
+        std::deque<Chunk> chunks;
+    };
+
+    std::vector<Band> &bands;
+    std::vector<std::unique_ptr<Tuner>> &tuners;
+    std::vector<std::unique_ptr<Queue>> queues;
+    Queue retry;                    // Channels left by failed chunks; taken by any worker
+    std::atomic<int> working{0};    // Workers holding a chunk (they may give part of it back)
+    std::atomic<int> alive{0};      // Workers not retired or finished
+    std::vector<std::vector<Result>> results;
+    unsigned tuneDelay;
+    std::mutex reportLock;
+
+    // Takes a chunk from the queue. working is incremented while the queue is locked, so a chunk is never
+    // out of the queues without being counted.
+    bool take(Queue &queue, Chunk *chunk, bool front)
+    {
+        std::lock_guard<std::mutex> guard(queue.lock);
+        if (queue.chunks.empty())
+            return false;
+        *chunk = front ? queue.chunks.front() : queue.chunks.back();
+        if (front)
+            queue.chunks.pop_front();
+        else
+            queue.chunks.pop_back();
+        this->working++;
+        return true;
+    }
+
+    // Takes the first retried chunk that was not given back by this tuner. A tuner takes its own failed
+    // chunks only when it is the last one working, so a broken tuner cannot use up the attempts of a channel.
+    bool takeRetry(size_t self, Chunk *chunk)
+    {
+        std::lock_guard<std::mutex> guard(this->retry.lock);
+        bool last = (this->alive == 1);
+        for (std::deque<Chunk>::iterator it = this->retry.chunks.begin(); it != this->retry.chunks.end(); ++it)
+        {
+            if (it->failedTuner != (int16_t)self || last)
+            {
+                *chunk = *it;
+                this->retry.chunks.erase(it);
+                this->working++;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Own chunks are taken from the front (channels in order), then the retried ones,
+    // then chunks stolen from the back of the longest queue.
+    bool takeAny(size_t self, Chunk *chunk)
+    {
+        if (take(*this->queues[self], chunk, true) || takeRetry(self, chunk))
+            return true;
+
+        for (;;)
+        {
+            size_t victim = self, most = 0;
+            for (size_t i = 0; i < this->queues.size(); i++)
+            {
+                std::lock_guard<std::mutex> guard(this->queues[i]->lock);
+                if (this->queues[i]->chunks.size() > most)
+                {
+                    most = this->queues[i]->chunks.size();
+                    victim = i;
+                }
+            }
+            if (most == 0)
+                return false;
+            if (take(*this->queues[victim], chunk, false)) // It may have been taken meanwhile
+                return true;
+        }
+    }
+
+    // Waits while other workers hold chunks, because they may put channels back in the retry queue.
+    bool nextChunk(size_t self, Chunk *chunk)
+    {
+        for (;;)
+        {
+            int busy = this->working; // Read before the queues: a chunk given back before this point is seen below
+            if (takeAny(self, chunk))
+                return true;
+            if (busy == 0)
+                return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    // Puts the channels of the chunk from channel n on back in the retry queue.
+    // channelFailed: the tune or status read of channel n failed (a mode change failure is not counted against the channel).
+    void giveBack(Tuner &tuner, size_t self, const Chunk &chunk, uint16_t n, bool channelFailed)
+    {
+        Band &b = this->bands[chunk.band];
+        uint8_t attempts = (uint8_t)(((n == 0) ? chunk.attempts : 0) + (channelFailed ? 1 : 0));
+        Chunk rest = {chunk.band, chunk.firstFrequency + (uint32_t)n * b.step, (uint16_t)(chunk.count - n), attempts, (int16_t)self};
+
+        if (rest.attempts >= MAX_CHANNEL_ATTEMPTS)
+        {
+            report(tuner, "channel skipped after repeated failures", rest.firstFrequency);
+            rest.firstFrequency += b.step;
+            rest.count--;
+            rest.attempts = 0;
+        }
+        if (rest.count > 0)
+        {
+            std::lock_guard<std::mutex> guard(this->retry.lock);
+            this->retry.chunks.push_back(rest);
+        }
+    }
+
+    // Scans the chunk. Returns the number of channels scanned before a failure (chunk.count if none).
+    // channelFailed is set when the failure was the tune or the status read of a channel.
+    uint16_t scan(Tuner &tuner, size_t self, const Chunk &chunk, bool *channelFailed)
+    {
+        Band &b = this->bands[chunk.band];
+        uint16_t n;
+
+        *channelFailed = false;
+        if (!tuner.setMode(b.mode))
+        {
+            report(tuner, "could not set the mode", chunk.firstFrequency);
+            return 0;
+        }
+        *channelFailed = true;
+        for (n = 0; n < chunk.count; n++)
+        {
+            Result r = {chunk.band, chunk.firstFrequency + (uint32_t)n * b.step, 0, 0, tuner.index};
+            if (!tuner.setFrequency(b.mode, r.frequency))
+            {
+                report(tuner, "tune failed", r.frequency);
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(this->tuneDelay));
+            if (!tuner.getSignal(b.mode, &r.rssi, &r.snr))
+            {
+                report(tuner, "status read failed", r.frequency);
+                break;
+            }
+            this->results[self].push_back(r);
+        }
+        if (n == chunk.count)
+            *channelFailed = false;
+        return n;
+    }
+
+    void worker(size_t self)
+    {
+        Tuner &tuner = *this->tuners[self];
+        Chunk chunk;
+        int failures = 0;
+        bool channelFailed;
+
+        while (nextChunk(self, &chunk))
+        {
+            uint16_t scanned = scan(tuner, self, chunk, &channelFailed);
+            if (scanned < chunk.count)
+            {
+                giveBack(tuner, self, chunk, scanned, channelFailed);
+                failures = (scanned == 0) ? failures + 1 : 1;
+            }
+            else
+                failures = 0;
+            this->working--; // After giveBack, so an idle worker waits for the channels given back
+
+            if (failures >= MAX_TUNER_FAILURES)
+            {
+                report(tuner, "retired after repeated failures", 0);
+                break;
+            }
+        }
+        this->alive--;
+    }
+
+    void report(Tuner &tuner, const char *message, uint32_t frequency)
+    {
+        std::lock_guard<std::mutex> guard(this->reportLock);
+        if (frequency != 0)
+            fprintf(stderr, "%s:0x%02x: %s (%u KHz)\n", tuner.busName.c_str(), tuner.getAddress(), message, frequency);
+        else
+            fprintf(stderr, "%s:0x%02x: %s\n", tuner.busName.c_str(), tuner.getAddress(), message);
+    }
+
+public:
+    Scheduler(std::vector<Band> &bands, std::vector<std::unique_ptr<Tuner>> &tuners, unsigned tuneDelay) : bands(bands), tuners(tuners), tuneDelay(tuneDelay)
+    {
+        for (size_t i = 0; i < tuners.size(); i++)
+            this->queues.emplace_back(new Queue());
+        this->results.resize(tuners.size());
+    }
+
+    // Splits the bands into chunks; each tuner starts with a contiguous part of the list.
+    // Returns the number of channels.
+    uint32_t split(uint16_t chunkSize)
+    {
+        uint32_t total = 0;
+        std::vector<Chunk> all;
+        for (uint16_t i = 0; i < this->bands.size(); i++)
+        {
+            Band &b = this->bands[i];
+            uint32_t channels = (b.maximumFrequency - b.minimumFrequency) / b.step + 1;
+            total += channels;
+            for (uint32_t c = 0; c < channels; c += chunkSize)
+                all.push_back({i, b.minimumFrequency + c * b.step, (uint16_t)std::min<uint32_t>(chunkSize, channels - c), 0, -1});
+        }
+
+        size_t perTuner = (all.size() + this->queues.size() - 1) / this->queues.size();
+        for (size_t i = 0; i < all.size(); i++)
+            this->queues[i / perTuner]->chunks.push_back(all[i]);
+        return total;
+    }
+
+    std::vector<Result> run()
+    {
+        std::vector<std::thread> threads;
+        std::vector<Result> merged;
+
+        this->alive = (int)this->tuners.size();
+        for (size_t i = 0; i < this->tuners.size(); i++)
+            threads.emplace_back(&Scheduler::worker, this, i);
+        for (std::thread &t : threads)
+            t.join();
+
+        for (std::vector<Result> &r : this->results)
+            merged.insert(merged.end(), r.begin(), r.end());
+        std::sort(merged.begin(), merged.end(), [](const Result &a, const Result &b) {
+            return (a.band != b.band) ? a.band < b.band : a.frequency < b.frequency;
+        });
+        return merged;
+    }
+};
+
+static void showHelp(const char *name)
+{
+    fprintf(stderr,
+            "Usage: %s -t BUS[:ADDRESS] [-t BUS[:ADDRESS] ...] -b BAND [-b BAND ...] [-c CHUNK] [-d DELAY]\n"
+            "  -t  tuner, for example /dev/i2c-1 or /dev/i2c-1:0x35 (default address 0x35)\n"
+            "  -b  band as fm|am:MIN:MAX:STEP (KHz), for example fm:87500:108000:100 or am:520:1710:10\n"
+            "  -c  channels per chunk (default 16)\n"
+            "  -d  tune wait in ms (default 30)\n",
+            name);
+}
+
+static bool parseBand(const char *arg, Band *b)
+{
+    char mode[3];
+    unsigned long minimum, maximum, step;
+    if (sscanf(arg, "%2[afm]:%lu:%lu:%lu", mode, &minimum, &maximum, &step) != 4 || step == 0 || step > 0xFFFF || maximum < minimum)
+        return false;
+    if (strcmp(mode, "fm") != 0 && strcmp(mode, "am") != 0)
+        return false;
+    b->mode = (mode[0] == 'a') ? MODE_AM : MODE_FM;
+    b->minimumFrequency = minimum;
+    b->maximumFrequency = maximum;
+    b->step = (uint16_t)step;
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<Band> bands;
+    std::vector<std::unique_ptr<Tuner>> tuners;
+    std::map<std::string, std::unique_ptr<std::mutex>> busLocks;
+    unsigned chunkSize = 16, tuneDelay = 30;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "t:b:c:d:h")) != -1)
+    {
+        switch (opt)
+        {
+        case 't':
+        {
+            std::string arg(optarg), bus = arg;
+            int address = KT0915_I2C_ADDRESS;
+            size_t colon = arg.find(':');
+            if (colon != std::string::npos)
+            {
+                bus = arg.substr(0, colon);
+                address = (int)strtol(arg.c_str() + colon + 1, NULL, 0);
+            }
+            std::unique_ptr<std::mutex> &lock = busLocks[bus];
+            if (!lock)
+                lock.reset(new std::mutex());
+            tuners.emplace_back(new Tuner(bus, address, lock.get(), (uint16_t)tuners.size()));
+            break;
+        }
+        case 'b':
+        {
+            Band b;
+            if (!parseBand(optarg, &b))
+            {
+                fprintf(stderr, "Invalid band: %s\n", optarg);
+                return 1;
+            }
+            bands.push_back(b);
+            break;
+        }
+        case 'c':
+            chunkSize = (unsigned)atoi(optarg);
+            break;
+        case 'd':
+            tuneDelay = (unsigned)atoi(optarg);
+            break;
+        default:
+            showHelp(argv[0]);
+            return 1;
+        }
+    }
+
+    if (tuners.empty() || bands.empty() || chunkSize == 0 || chunkSize > 0xFFFF)
+    {
+        showHelp(argv[0]);
+        return 1;
+    }
+
+    for (std::unique_ptr<Tuner> &t : tuners)
+    {
+        if (!t->open())
+        {
+            perror(t->busName.c_str());
+            return 1;
+        }
+    }
+
+    Scheduler scheduler(bands, tuners, tuneDelay);
+    uint32_t channels = scheduler.split((uint16_t)chunkSize);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<Result> results = scheduler.run();
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    printf("band,mode,frequency,rssi,snr,tuner\n");
+    for (Result &r : results)
+        printf("%u,%s,%u,%d,%d,%s:0x%02x\n", r.band, (bands[r.band].mode == MODE_AM) ? "AM" : "FM", r.frequency, r.rssi, r.snr, tuners[r.tuner]->busName.c_str(), tuners[r.tuner]->getAddress());
+
+    fprintf(stderr, "%zu channels in %lld ms with %zu tuners\n", results.size(), (long long)elapsed.count(), tuners.size());
+    if (results.size() < channels)
+    {
+        fprintf(stderr, "%zu channels were not scanned\n", channels - results.size());
+        return 2;
+    }
+    return 0;
+}